@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Simulate GithubReleaseOTA peers on a LAN host.
+
+Serves `/ota/info` and `/ota/firmware.bin` for a release `firmware.bin`,
+one peer per port starting at `--port`. Add the peers on a device with
+`ota.addPeer("<host ip>", <port>)` and flash the same release.
+
+Peer modes and the expected result on the device:
+
+  good        serves the firmware, device flashes from this peer
+  wrong-hash  advertises another SHA-256, device skips the peer
+  wrong-id    advertises another asset id, device skips the peer
+  wrong-size  sends a Content-Length different from the asset size, device skips the peer
+  chunked     sends the firmware without Content-Length, device skips the peer
+  big-info    sends an oversized /ota/info body, device skips the peer
+  corrupt     serves the firmware with one byte flipped, device returns OTA_VERIFY_ERROR for this peer
+  truncated   closes the connection half way, device returns OTA_CONNECT_ERROR for this peer
+  stall       stops sending half way but keeps the connection open, device times out with OTA_CONNECT_ERROR
+
+When no peer can serve the firmware, the device falls back to GitHub.
+
+Example:
+
+  python3 extras/peer_simulator.py firmware.bin --id 123456 --tag v1.0.1 \\
+      --peer stall --peer corrupt --peer good
+"""
+
+import argparse
+import hashlib
+import json
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+INFO_PATH = "/ota/info"
+IMAGE_PATH = "/ota/firmware.bin"
+MODES = ("good", "wrong-hash", "wrong-id", "wrong-size", "chunked", "big-info", "corrupt", "truncated", "stall")
+
+
+def make_handler(mode, image, asset_id, tag):
+    sha256 = hashlib.sha256(image).hexdigest()
+
+    class PeerHandler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, format, *args):
+            print("[%s:%d] %s" % (mode, self.server.server_port, format % args))
+
+        def send_body(self, code, content_type, body, length=None):
+            self.send_response(code)
+            self.send_header("Content-Type", content_type)
+            self.send_header("Content-Length", str(len(body) if length is None else length))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def do_GET(self):
+            if self.path == INFO_PATH:
+                self.handle_info()
+            elif self.path == IMAGE_PATH:
+                self.handle_image()
+            else:
+                self.send_body(404, "text/plain", b"Not found")
+
+        def handle_info(self):
+            info = {"tag": tag, "id": asset_id, "size": len(image), "sha256": sha256}
+
+            if mode == "wrong-hash":
+                info["sha256"] = hashlib.sha256(image + b"\0").hexdigest()
+            elif mode == "wrong-id":
+                info["id"] = asset_id + 1
+            elif mode == "big-info":
+                info["padding"] = "x" * 65536
+
+            self.send_body(200, "application/json", json.dumps(info).encode())
+
+        def handle_image(self):
+            if mode == "wrong-size":
+                self.send_body(200, "application/octet-stream", image + b"\0")
+            elif mode == "chunked":
+                self.send_response(200)
+                self.send_header("Content-Type", "application/octet-stream")
+                self.send_header("Transfer-Encoding", "chunked")
+                self.end_headers()
+                for offset in range(0, len(image), 1024):
+                    chunk = image[offset:offset + 1024]
+                    self.wfile.write(b"%x\r\n%s\r\n" % (len(chunk), chunk))
+                self.wfile.write(b"0\r\n\r\n")
+            elif mode == "corrupt":
+                body = bytearray(image)
+                body[len(body) // 2] ^= 0xFF
+                self.send_body(200, "application/octet-stream", bytes(body))
+            elif mode == "truncated":
+                self.send_body(200, "application/octet-stream", image[:len(image) // 2], len(image))
+                self.close_connection = True
+            elif mode == "stall":
+                self.send_body(200, "application/octet-stream", image[:len(image) // 2], len(image))
+                self.wfile.flush()
+                while True:
+                    time.sleep(3600)
+            else:
+                self.send_body(200, "application/octet-stream", image)
+
+    return PeerHandler
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Simulate GithubReleaseOTA peers",
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     epilog=__doc__)
+    parser.add_argument("firmware", help="release firmware.bin")
+    parser.add_argument("--id", type=int, required=True, help="GitHub release asset id of firmware.bin")
+    parser.add_argument("--tag", default="", help="release tag name")
+    parser.add_argument("--host", default="0.0.0.0", help="address to listen on (default: 0.0.0.0)")
+    parser.add_argument("--port", type=int, default=8032, help="port of the first peer (default: 8032)")
+    parser.add_argument("--peer", action="append", choices=MODES,
+                        help="peer mode, repeat for more peers on consecutive ports (default: good)")
+    args = parser.parse_args()
+
+    with open(args.firmware, "rb") as f:
+        image = f.read()
+
+    print("firmware %s: id %d, size %d, sha256 %s" % (args.firmware, args.id, len(image), hashlib.sha256(image).hexdigest()))
+
+    for i, mode in enumerate(args.peer or ["good"]):
+        server = ThreadingHTTPServer((args.host, args.port + i), make_handler(mode, image, args.id, args.tag))
+        server.daemon_threads = True
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        print("peer %-10s on port %d" % (mode, args.port + i))
+
+    try:
+        while True:
+            time.sleep(3600)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
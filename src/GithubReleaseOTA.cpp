@@ -32,22 +32,30 @@ GithubReleaseOTA::GithubReleaseOTA(const char* owner, const char* repo, const ch
  * 
  */
 GithubReleaseOTA::~GithubReleaseOTA() {
-    if (this->releaseUrl != NULL)
-        free(this->releaseUrl);
-
-    if (this->token != NULL)
-        free(this->token);
-
-    if (this->ca != NULL)
-        free(this->ca);
+    clear();
 }
 
 /**
- * @brief Destroy the Github Release OTA object
+ * @brief Free allocated memory and stop peer server
  * 
  */
 void GithubReleaseOTA::clear() {
-    this->~GithubReleaseOTA();
+    if (this->releaseUrl != NULL) {
+        free(this->releaseUrl);
+        this->releaseUrl = NULL;
+    }
+
+    if (this->token != NULL) {
+        free(this->token);
+        this->token = NULL;
+    }
+
+    if (this->ca != NULL) {
+        free(this->ca);
+        this->ca = NULL;
+    }
+
+    freePeer();
 }
 
 /**
@@ -185,10 +193,10 @@ GithubReleaseAsset GithubReleaseOTA::getAssetByname(GithubRelease release, const
  * @brief Flash firmware
  * 
  * @param asset `GithubReleaseAsset` Github Release Asset Object
- * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5
+ * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5, `OTA_VERIFY_ERROR`:6
  */
 int GithubReleaseOTA::flashFirmware(GithubReleaseAsset asset) {
-    return GithubReleaseOTA::flashByAssetId(asset.id, FLASH_TYPE_FIRMWARE);
+    return GithubReleaseOTA::flashAsset(asset, FLASH_TYPE_FIRMWARE, NULL);
 }
 
 /**
@@ -196,24 +204,24 @@ int GithubReleaseOTA::flashFirmware(GithubReleaseAsset asset) {
  * 
  * @param release `GithubRelease` Github Release Object
  * @param name `const char*` Asset Name
- * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5
+ * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5, `OTA_VERIFY_ERROR`:6
  */
 int GithubReleaseOTA::flashFirmware(GithubRelease release, const char* name) {
     GithubReleaseAsset asset = getAssetByname(release, name);
     if (asset.browser_download_url == NULL)
         return OTA_NULL_URL;
 
-    return GithubReleaseOTA::flashByAssetId(asset.id, FLASH_TYPE_FIRMWARE);
+    return GithubReleaseOTA::flashAsset(asset, FLASH_TYPE_FIRMWARE, release.tag_name);
 }
 
 /**
  * @brief Flash SPIFFS
  * 
  * @param asset `GithubReleaseAsset` Github Release Asset Object
- * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5
+ * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5, `OTA_VERIFY_ERROR`:6
  */
 int GithubReleaseOTA::flashSpiffs(GithubReleaseAsset asset) {
-    return GithubReleaseOTA::flashByAssetId(asset.id, FLASH_TYPE_SPIFFS);
+    return GithubReleaseOTA::flashAsset(asset, FLASH_TYPE_SPIFFS, NULL);
 }
 
 /**
@@ -221,14 +229,14 @@ int GithubReleaseOTA::flashSpiffs(GithubReleaseAsset asset) {
  * 
  * @param release `GithubRelease` Github Release Object
  * @param name `const char*` Asset Name
- * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5
+ * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5, `OTA_VERIFY_ERROR`:6
  */
 int GithubReleaseOTA::flashSpiffs(GithubRelease release, const char* name) {
     GithubReleaseAsset asset = getAssetByname(release, name);
     if (asset.browser_download_url == NULL)
         return OTA_NULL_URL;
 
-    return GithubReleaseOTA::flashByAssetId(asset.id, FLASH_TYPE_SPIFFS);
+    return GithubReleaseOTA::flashAsset(asset, FLASH_TYPE_SPIFFS, release.tag_name);
 }
 
 /**
@@ -239,14 +247,27 @@ int GithubReleaseOTA::flashSpiffs(GithubRelease release, const char* name) {
  * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5
  */
 int GithubReleaseOTA::flashByAssetId(int assetId, int flashType) {
-    int urlSize = snprintf(NULL, 0, GITHUB_API_RELEASE_ASSETS_URL, this->releaseUrl, String(assetId)) + 1;
+    return GithubReleaseOTA::flashFromGithub(assetId, flashType, NULL, NULL);
+}
+
+/**
+ * @brief Flash asset downloaded from Github
+ * 
+ * @param assetId `int` Asset ID
+ * @param flashType `int` Flash Type, `U_FLASH` or `U_SPIFFS`
+ * @param sha256 `const char*` Expected SHA-256 hex string, `NULL` to skip verification
+ * @param tag `const char*` Release tag name, may be `NULL`
+ * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5, `OTA_VERIFY_ERROR`:6
+ */
+int GithubReleaseOTA::flashFromGithub(int assetId, int flashType, const char* sha256, const char* tag) {
+    int urlSize = snprintf(NULL, 0, GITHUB_API_RELEASE_ASSETS_URL, this->releaseUrl, String(assetId).c_str()) + 1;
     char* url = (char*)malloc(urlSize);
     if (url == NULL) {
         ESP_LOGE("GithubReleaseOTA", "Failed to allocate memory for asset URL");
         return OTA_NULL_URL;
     }
 
-    snprintf(url, urlSize, GITHUB_API_RELEASE_ASSETS_URL, this->releaseUrl, String(assetId)) + 1;
+    snprintf(url, urlSize, GITHUB_API_RELEASE_ASSETS_URL, this->releaseUrl, String(assetId).c_str());
 
     HTTPClient client;
     if (this->ca != NULL)
@@ -267,32 +288,67 @@ int GithubReleaseOTA::flashByAssetId(int assetId, int flashType) {
         return OTA_CONNECT_ERROR;
     }
 
+    int size = client.getSize();
+    char digest[GITHUB_OTA_SHA256_SIZE];
+    int result = writeStream(client, flashType, sha256, digest, GITHUB_OTA_STREAM_TIMEOUT);
+    client.end();
+    free(url);
+
+    if (result != OTA_SUCCESS)
+        return result;
+
+    if (flashType == FLASH_TYPE_FIRMWARE)
+        savePeerImage(tag, assetId, size, digest);
+
+    ESP_LOGI("GithubReleaseOTA", "OTA update successful");
+    return OTA_SUCCESS;
+}
+
+/**
+ * @brief Write HTTP response body to flash and verify its SHA-256
+ * 
+ * @param client `HTTPClient&` Connected HTTP client
+ * @param flashType `int` Flash Type, `U_FLASH` or `U_SPIFFS`
+ * @param sha256 `const char*` Expected SHA-256 hex string, `NULL` to skip verification
+ * @param digest `char*` Output SHA-256 hex string of the written image, `GITHUB_OTA_SHA256_SIZE` bytes
+ * @param timeout `uint32_t` Abort if no data is received for this many milliseconds
+ * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5, `OTA_VERIFY_ERROR`:6
+ */
+int GithubReleaseOTA::writeStream(HTTPClient& client, int flashType, const char* sha256, char* digest, uint32_t timeout) {
+    if (flashType == FLASH_TYPE_FIRMWARE)
+        invalidatePeerImage();
+
     int size = client.getSize();
     if (!Update.begin(size, flashType)) {
         ESP_LOGE("GithubReleaseOTA", "Failed to begin OTA update");
-        client.end();
-        free(url);
         return OTA_BEGIN_ERROR;
     }
 
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+
     // Use the HTTPClient's stream directly
     Stream &stream = client.getStream();
     size_t written = 0;
     const size_t chunkSize = 1024; // Set chunk size
     uint8_t buffer[chunkSize];
     int lastProgress = -1;
+    uint32_t lastReceived = millis();
 
     while (written < size) {
         size_t available = stream.available();
         if (available > 0) {
+            lastReceived = millis();
             size_t readSize = stream.readBytes(buffer, min(available, chunkSize));
             if (readSize > 0) {
                 if (Update.write(buffer, readSize) != readSize) {
                     ESP_LOGE("GithubReleaseOTA", "Error writing chunk");
-                    client.end();
-                    free(url);
+                    mbedtls_sha256_free(&sha);
+                    Update.abort();
                     return OTA_WRITE_ERROR;
                 }
+                mbedtls_sha256_update(&sha, buffer, readSize);
                 written += readSize;
                 ESP_LOGI("GithubReleaseOTA", "Written %d/%d bytes", written, size);
             }
@@ -304,20 +360,38 @@ int GithubReleaseOTA::flashByAssetId(int assetId, int flashType) {
                 }
             lastProgress = progress;
             }
+        } else if (!client.connected()) {
+            ESP_LOGE("GithubReleaseOTA", "Connection closed at %d/%d bytes", written, size);
+            mbedtls_sha256_free(&sha);
+            Update.abort();
+            return OTA_CONNECT_ERROR;
+        } else if (millis() - lastReceived > timeout) {
+            ESP_LOGE("GithubReleaseOTA", "Timed out at %d/%d bytes", written, size);
+            mbedtls_sha256_free(&sha);
+            Update.abort();
+            return OTA_CONNECT_ERROR;
         }
         delay(1);
     }
 
+    uint8_t hash[32];
+    mbedtls_sha256_finish(&sha, hash);
+    mbedtls_sha256_free(&sha);
+
+    for (int i = 0; i < 32; i++)
+        snprintf(digest + i * 2, 3, "%02x", hash[i]);
+
+    if (sha256 != NULL && strcasecmp(digest, sha256) != 0) {
+        ESP_LOGE("GithubReleaseOTA", "SHA-256 mismatch, expected %s got %s", sha256, digest);
+        Update.abort();
+        return OTA_VERIFY_ERROR;
+    }
+
     if (!Update.end()) {
         ESP_LOGE("GithubReleaseOTA", "Failed to end OTA update");
-        client.end();
-        free(url);
         return OTA_END_ERROR;
     }
 
-    ESP_LOGI("GithubReleaseOTA", "OTA update successful");
-    client.end();
-    free(url);
     return OTA_SUCCESS;
 }
 
@@ -365,6 +439,7 @@ void GithubReleaseOTA::freeReleaseAsset(GithubReleaseAsset& asset) {
     if (asset.created_at != NULL) free((void*)asset.created_at);
     if (asset.updated_at != NULL) free((void*)asset.updated_at);
     if (asset.browser_download_url != NULL) free((void*)asset.browser_download_url);
+    if (asset.digest != NULL) free((void*)asset.digest);
 }
 
 /**
@@ -503,6 +578,7 @@ GithubRelease GithubReleaseOTA::makeRelease(String payload) {
         githubAsset.created_at = copyString(asset["created_at"]);
         githubAsset.updated_at = copyString(asset["updated_at"]);
         githubAsset.browser_download_url = copyString(asset["browser_download_url"]);
+        githubAsset.digest = copyString(asset["digest"]);
         githubRelease.assets.push_back(githubAsset);
     }
 
@@ -512,3 +588,478 @@ GithubRelease GithubReleaseOTA::makeRelease(String payload) {
 
     return githubRelease;
 }
+
+/**
+ * @brief Get the SHA-256 hex string from the asset digest
+ * 
+ * @param asset `GithubReleaseAsset` Github Release Asset Object
+ * @return `const char*` SHA-256 hex string, `NULL` if the release does not publish one
+ */
+const char* GithubReleaseOTA::getAssetSha256(GithubReleaseAsset asset) {
+    size_t prefixSize = strlen(GITHUB_OTA_DIGEST_PREFIX);
+
+    if (asset.digest == NULL || strncmp(asset.digest, GITHUB_OTA_DIGEST_PREFIX, prefixSize) != 0)
+        return NULL;
+
+    if (strlen(asset.digest + prefixSize) != GITHUB_OTA_SHA256_SIZE - 1)
+        return NULL;
+
+    return asset.digest + prefixSize;
+}
+
+/**
+ * @brief Flash asset, prefer peers for firmware when the release publishes a digest
+ * 
+ * @param asset `GithubReleaseAsset` Github Release Asset Object
+ * @param flashType `int` Flash Type, `U_FLASH` or `U_SPIFFS`
+ * @param tag `const char*` Release tag name, may be `NULL`
+ * @return `int` OTA Status, `OTA_SUCCESS`:0, `OTA_NULL_URL`:1, `OTA_CONNECT_ERROR`:2, `OTA_BEGIN_ERROR`:3, `OTA_WRITE_ERROR`:4, `OTA_END_ERROR`:5, `OTA_VERIFY_ERROR`:6
+ */
+int GithubReleaseOTA::flashAsset(GithubReleaseAsset asset, int flashType, const char* tag) {
+    const char* sha256 = getAssetSha256(asset);
+
+    if (flashType == FLASH_TYPE_FIRMWARE && sha256 != NULL && !this->peers.empty()) {
+        if (flashFromPeers(asset, sha256, tag) == OTA_SUCCESS)
+            return OTA_SUCCESS;
+
+        ESP_LOGW("GithubReleaseOTA", "No peer could serve asset %d, falling back to GitHub", asset.id);
+    }
+
+    return flashFromGithub(asset.id, flashType, sha256, tag);
+}
+
+/**
+ * @brief Flash firmware downloaded from the first peer that serves the asset
+ * 
+ * @param asset `GithubReleaseAsset` Github Release Asset Object
+ * @param sha256 `const char*` Expected SHA-256 hex string
+ * @param tag `const char*` Release tag name, may be `NULL`
+ * @return `int` OTA Status of the last attempted peer, `OTA_CONNECT_ERROR` if no peer serves the asset
+ */
+int GithubReleaseOTA::flashFromPeers(GithubReleaseAsset asset, const char* sha256, const char* tag) {
+    int result = OTA_CONNECT_ERROR;
+
+    for (GithubPeer peer : this->peers) {
+        if (!peerHasImage(peer, asset, sha256))
+            continue;
+
+        int urlSize = snprintf(NULL, 0, GITHUB_OTA_PEER_URL, peer.host.c_str(), peer.port, GITHUB_OTA_PEER_IMAGE_PATH) + 1;
+        char* url = (char*)malloc(urlSize);
+        if (url == NULL) {
+            ESP_LOGE("GithubReleaseOTA", "Failed to allocate memory for peer URL");
+            continue;
+        }
+
+        snprintf(url, urlSize, GITHUB_OTA_PEER_URL, peer.host.c_str(), peer.port, GITHUB_OTA_PEER_IMAGE_PATH);
+
+        HTTPClient client;
+        client.begin(url);
+        client.setConnectTimeout(GITHUB_OTA_PEER_TIMEOUT);
+        client.setTimeout(GITHUB_OTA_PEER_TIMEOUT);
+
+        if (client.GET() != HTTP_CODE_OK) {
+            ESP_LOGW("GithubReleaseOTA", "Failed to connect to peer %s", url);
+            client.end();
+            free(url);
+            continue;
+        }
+
+        int size = client.getSize();
+        if (size <= 0 || size != asset.size) {
+            ESP_LOGW("GithubReleaseOTA", "Peer %s size %d does not match asset size %d", url, size, asset.size);
+            client.end();
+            free(url);
+            continue;
+        }
+
+        char digest[GITHUB_OTA_SHA256_SIZE];
+        result = writeStream(client, FLASH_TYPE_FIRMWARE, sha256, digest, GITHUB_OTA_PEER_TIMEOUT);
+        client.end();
+
+        if (result == OTA_SUCCESS) {
+            ESP_LOGI("GithubReleaseOTA", "OTA update successful from peer %s", url);
+            free(url);
+            savePeerImage(tag, asset.id, size, digest);
+            return OTA_SUCCESS;
+        }
+
+        ESP_LOGW("GithubReleaseOTA", "OTA update from peer %s failed: %d", url, result);
+        free(url);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Start peer server, serve the installed firmware to other devices on LAN
+ * 
+ * Call `MDNS.begin()` first to advertise the server for `discoverPeers()`.
+ * The server has no authentication, firmware of a private repository is only served with `allowPrivate`.
+ * The server is started once, later calls keep the first port and only report its state.
+ * 
+ * @param port `uint16_t` HTTP port
+ * @param allowPrivate `bool` Serve firmware even if a Github token is set
+ * @return `bool` `true` if an installed firmware is served, `false` if the server was refused for a private repository or no installed firmware is available
+ */
+bool GithubReleaseOTA::beginPeerServer(uint16_t port, bool allowPrivate) {
+    if (this->token != NULL && !allowPrivate) {
+        ESP_LOGW("GithubReleaseOTA", "Peer server refused for private repository, set allowPrivate to serve it");
+        return false;
+    }
+
+    if (this->peerServer != NULL) {
+        if (port != this->peerPort)
+            ESP_LOGW("GithubReleaseOTA", "Peer server already running on port %d", this->peerPort);
+        return getPeerPartition() != NULL;
+    }
+
+    loadPeerImage();
+
+    if (this->peerImage.id != 0) {
+        const esp_partition_t* partition = getPeerPartition();
+        char digest[GITHUB_OTA_SHA256_SIZE];
+
+        if (partition == NULL || !hashPartition(partition, this->peerImage.size, digest) || strcasecmp(digest, this->peerImage.sha256) != 0) {
+            ESP_LOGW("GithubReleaseOTA", "Installed firmware does not match stored identity, not serving it");
+            clearPeerImage();
+        }
+    }
+
+    this->peerServer = new WebServer(port);
+    this->peerServer->on(GITHUB_OTA_PEER_INFO_PATH, HTTP_GET, [this]() { handlePeerInfo(); });
+    this->peerServer->on(GITHUB_OTA_PEER_IMAGE_PATH, HTTP_GET, [this]() { handlePeerImage(); });
+    this->peerServer->begin();
+    this->peerPort = port;
+
+    if (!MDNS.addService(GITHUB_OTA_PEER_SERVICE, GITHUB_OTA_PEER_PROTOCOL, port))
+        ESP_LOGW("GithubReleaseOTA", "Failed to advertise peer server, is mDNS started?");
+
+    if (getPeerPartition() == NULL) {
+        ESP_LOGI("GithubReleaseOTA", "Peer server started, no installed firmware to serve");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Handle peer server clients, Use on `Loop` function
+ * 
+ */
+void GithubReleaseOTA::handlePeerServer() {
+    if (this->peerServer != NULL)
+        this->peerServer->handleClient();
+}
+
+/**
+ * @brief Add peer to download firmware from before GitHub
+ * 
+ * @param host `const char*` Peer host or IP address
+ * @param port `uint16_t` Peer HTTP port
+ */
+void GithubReleaseOTA::addPeer(const char* host, uint16_t port) {
+    if (host == NULL)
+        return;
+
+    for (GithubPeer peer : this->peers) {
+        if (peer.host == host && peer.port == port)
+            return;
+    }
+
+    GithubPeer peer;
+    peer.host = host;
+    peer.port = port;
+    this->peers.push_back(peer);
+}
+
+/**
+ * @brief Discover peers advertised with mDNS, Call `MDNS.begin()` first
+ * 
+ * @return `int` Number of discovered peers
+ */
+int GithubReleaseOTA::discoverPeers() {
+    int count = MDNS.queryService(GITHUB_OTA_PEER_SERVICE, GITHUB_OTA_PEER_PROTOCOL);
+
+    for (int i = 0; i < count; i++) {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+        IPAddress ip = MDNS.address(i);
+#else
+        IPAddress ip = MDNS.IP(i);
+#endif
+        addPeer(ip.toString().c_str(), MDNS.port(i));
+    }
+
+    return count > 0 ? count : 0;
+}
+
+/**
+ * @brief Stop peer server and remove all peers
+ * 
+ */
+void GithubReleaseOTA::freePeer() {
+    if (this->peerServer != NULL) {
+        this->peerServer->stop();
+        delete this->peerServer;
+        this->peerServer = NULL;
+        this->peerPort = 0;
+
+        mdns_service_remove("_" GITHUB_OTA_PEER_SERVICE, "_" GITHUB_OTA_PEER_PROTOCOL);
+    }
+
+    clearPeers();
+}
+
+/**
+ * @brief Remove all peers
+ * 
+ */
+void GithubReleaseOTA::clearPeers() {
+    this->peers.clear();
+}
+
+/**
+ * @brief Check peer serves the asset with the expected size and SHA-256
+ * 
+ * @param peer `GithubPeer` Peer
+ * @param asset `GithubReleaseAsset` Github Release Asset Object
+ * @param sha256 `const char*` Expected SHA-256 hex string
+ * @return `bool` `true` if the peer serves the asset
+ */
+bool GithubReleaseOTA::peerHasImage(GithubPeer peer, GithubReleaseAsset asset, const char* sha256) {
+    int urlSize = snprintf(NULL, 0, GITHUB_OTA_PEER_URL, peer.host.c_str(), peer.port, GITHUB_OTA_PEER_INFO_PATH) + 1;
+    char* url = (char*)malloc(urlSize);
+    if (url == NULL) {
+        ESP_LOGE("GithubReleaseOTA", "Failed to allocate memory for peer URL");
+        return false;
+    }
+
+    snprintf(url, urlSize, GITHUB_OTA_PEER_URL, peer.host.c_str(), peer.port, GITHUB_OTA_PEER_INFO_PATH);
+
+    HTTPClient http;
+    http.begin(url);
+    http.setConnectTimeout(GITHUB_OTA_PEER_TIMEOUT);
+    http.setTimeout(GITHUB_OTA_PEER_TIMEOUT);
+    int code = http.GET();
+    int size = http.getSize();
+
+    if (code != HTTP_CODE_OK || size <= 0 || size > GITHUB_OTA_PEER_INFO_SIZE) {
+        if (code == HTTP_CODE_OK)
+            ESP_LOGW("GithubReleaseOTA", "Peer %s info size %d is not in 1..%d", url, size, GITHUB_OTA_PEER_INFO_SIZE);
+        http.end();
+        free(url);
+        return false;
+    }
+
+    String payload = http.getString();
+    http.end();
+    free(url);
+
+    JsonDocument info;
+    if (deserializeJson(info, payload))
+        return false;
+
+    const char* peerSha256 = info["sha256"];
+    bool match = info["id"] == asset.id && info["size"] == asset.size && peerSha256 != NULL && strcasecmp(peerSha256, sha256) == 0;
+    info.clear();
+
+    return match;
+}
+
+/**
+ * @brief Get the app partition holding the installed firmware
+ * 
+ * @return `const esp_partition_t*` Running or boot partition, `NULL` if no installed firmware is known
+ */
+const esp_partition_t* GithubReleaseOTA::getPeerPartition() {
+    if (this->peerImage.id == 0 || this->peerImage.size <= 0)
+        return NULL;
+
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    if (running != NULL && strcmp(running->label, this->peerImage.partition) == 0)
+        return running;
+
+    const esp_partition_t* boot = esp_ota_get_boot_partition();
+    if (boot != NULL && strcmp(boot->label, this->peerImage.partition) == 0)
+        return boot;
+
+    return NULL;
+}
+
+/**
+ * @brief Load installed firmware identity from NVS
+ * 
+ */
+void GithubReleaseOTA::loadPeerImage() {
+    Preferences prefs;
+    if (!prefs.begin(GITHUB_OTA_PEER_NAMESPACE, true))
+        return;
+
+    prefs.getString("tag", this->peerImage.tag, sizeof(this->peerImage.tag));
+    this->peerImage.id = prefs.getInt("id", 0);
+    this->peerImage.size = prefs.getInt("size", 0);
+    prefs.getString("sha256", this->peerImage.sha256, sizeof(this->peerImage.sha256));
+    prefs.getString("partition", this->peerImage.partition, sizeof(this->peerImage.partition));
+    prefs.end();
+}
+
+/**
+ * @brief Clear installed firmware identity from memory and NVS
+ * 
+ */
+void GithubReleaseOTA::clearPeerImage() {
+    this->peerImage = GithubPeerImage();
+
+    Preferences prefs;
+    if (!prefs.begin(GITHUB_OTA_PEER_NAMESPACE, false)) {
+        ESP_LOGE("GithubReleaseOTA", "Failed to open NVS for peer image");
+        return;
+    }
+
+    prefs.clear();
+    prefs.end();
+}
+
+/**
+ * @brief Clear installed firmware identity if the next firmware update overwrites its partition
+ * 
+ */
+void GithubReleaseOTA::invalidatePeerImage() {
+    if (this->peerImage.id == 0)
+        loadPeerImage();
+
+    if (this->peerImage.id == 0)
+        return;
+
+    const esp_partition_t* next = esp_ota_get_next_update_partition(NULL);
+    if (next == NULL || strcmp(next->label, this->peerImage.partition) == 0)
+        clearPeerImage();
+}
+
+/**
+ * @brief Compute SHA-256 of the first bytes of a partition
+ * 
+ * @param partition `const esp_partition_t*` Partition
+ * @param size `size_t` Number of bytes to hash
+ * @param digest `char*` Output SHA-256 hex string, `GITHUB_OTA_SHA256_SIZE` bytes
+ * @return `bool` `true` if the partition was read successfully
+ */
+bool GithubReleaseOTA::hashPartition(const esp_partition_t* partition, size_t size, char* digest) {
+    if (size == 0 || size > partition->size)
+        return false;
+
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+
+    size_t offset = 0;
+    const size_t chunkSize = 1024;
+    uint8_t buffer[chunkSize];
+
+    while (offset < size) {
+        size_t readSize = min(size - offset, chunkSize);
+        if (esp_partition_read(partition, offset, buffer, readSize) != ESP_OK) {
+            ESP_LOGE("GithubReleaseOTA", "Failed to read partition %s", partition->label);
+            mbedtls_sha256_free(&sha);
+            return false;
+        }
+
+        mbedtls_sha256_update(&sha, buffer, readSize);
+        offset += readSize;
+    }
+
+    uint8_t hash[32];
+    mbedtls_sha256_finish(&sha, hash);
+    mbedtls_sha256_free(&sha);
+
+    for (int i = 0; i < 32; i++)
+        snprintf(digest + i * 2, 3, "%02x", hash[i]);
+
+    return true;
+}
+
+/**
+ * @brief Save installed firmware identity to NVS
+ * 
+ * @param tag `const char*` Release tag name, may be `NULL`
+ * @param id `int` Asset ID
+ * @param size `int` Firmware size
+ * @param sha256 `const char*` SHA-256 hex string
+ */
+void GithubReleaseOTA::savePeerImage(const char* tag, int id, int size, const char* sha256) {
+    const esp_partition_t* partition = esp_ota_get_boot_partition();
+    if (partition == NULL)
+        return;
+
+    snprintf(this->peerImage.tag, sizeof(this->peerImage.tag), "%s", tag != NULL ? tag : "");
+    this->peerImage.id = id;
+    this->peerImage.size = size;
+    snprintf(this->peerImage.sha256, sizeof(this->peerImage.sha256), "%s", sha256);
+    snprintf(this->peerImage.partition, sizeof(this->peerImage.partition), "%s", partition->label);
+
+    Preferences prefs;
+    if (!prefs.begin(GITHUB_OTA_PEER_NAMESPACE, false)) {
+        ESP_LOGE("GithubReleaseOTA", "Failed to open NVS for peer image");
+        return;
+    }
+
+    prefs.putString("tag", this->peerImage.tag);
+    prefs.putInt("id", this->peerImage.id);
+    prefs.putInt("size", this->peerImage.size);
+    prefs.putString("sha256", this->peerImage.sha256);
+    prefs.putString("partition", this->peerImage.partition);
+    prefs.end();
+}
+
+/**
+ * @brief Handle `GITHUB_OTA_PEER_INFO_PATH`, respond installed firmware identity
+ * 
+ */
+void GithubReleaseOTA::handlePeerInfo() {
+    if (getPeerPartition() == NULL) {
+        this->peerServer->send(404, "text/plain", "No firmware");
+        return;
+    }
+
+    JsonDocument info;
+    info["tag"] = this->peerImage.tag;
+    info["id"] = this->peerImage.id;
+    info["size"] = this->peerImage.size;
+    info["sha256"] = this->peerImage.sha256;
+
+    String payload;
+    serializeJson(info, payload);
+    info.clear();
+
+    this->peerServer->send(200, "application/json", payload);
+}
+
+/**
+ * @brief Handle `GITHUB_OTA_PEER_IMAGE_PATH`, stream installed firmware from its app partition
+ * 
+ */
+void GithubReleaseOTA::handlePeerImage() {
+    const esp_partition_t* partition = getPeerPartition();
+    if (partition == NULL) {
+        this->peerServer->send(404, "text/plain", "No firmware");
+        return;
+    }
+
+    size_t size = this->peerImage.size;
+    this->peerServer->setContentLength(size);
+    this->peerServer->send(200, GITHUB_API_RELEASE_ASSETS_ACCEPT_OCTET_STREAM, "");
+
+    size_t offset = 0;
+    const size_t chunkSize = 1024;
+    uint8_t buffer[chunkSize];
+
+    while (offset < size) {
+        size_t readSize = min(size - offset, chunkSize);
+        if (esp_partition_read(partition, offset, buffer, readSize) != ESP_OK) {
+            ESP_LOGE("GithubReleaseOTA", "Failed to read partition %s", partition->label);
+            break;
+        }
+
+        this->peerServer->sendContent((const char*)buffer, readSize);
+        offset += readSize;
+    }
+}
@@ -5,10 +5,16 @@
     #include <HTTPClient.h>
     #include <Update.h>
     #include <ArduinoJson.h>
+    #include <WebServer.h>
+    #include <ESPmDNS.h>
+    #include <Preferences.h>
 
     #include <vector>
 
     #include <esp_log.h>
+    #include <esp_ota_ops.h>
+    #include <mdns.h>
+    #include <mbedtls/sha256.h>
 
     #define GITHUB_API_RELEASE_URL        "https://api.github.com/repos/%s/%s/releases"
 
@@ -27,6 +33,7 @@
     #define OTA_BEGIN_ERROR   3
     #define OTA_WRITE_ERROR   4
     #define OTA_END_ERROR     5
+    #define OTA_VERIFY_ERROR  6
 
     #define FLASH_TYPE_FIRMWARE U_FLASH
     #define FLASH_TYPE_SPIFFS   U_SPIFFS
@@ -34,6 +41,22 @@
     #define GITHUB_OTA_FIRMWARE_NAME "firmware.bin"
     #define GITHUB_OTA_SPIFFS_NAME "spiffs.bin"
 
+    #define GITHUB_OTA_DIGEST_PREFIX        "sha256:"
+    #define GITHUB_OTA_SHA256_SIZE          65
+    #define GITHUB_OTA_TAG_SIZE             64
+    #define GITHUB_OTA_PARTITION_LABEL_SIZE 17
+    #define GITHUB_OTA_STREAM_TIMEOUT       10000
+
+    #define GITHUB_OTA_PEER_PORT       8032
+    #define GITHUB_OTA_PEER_TIMEOUT    2000
+    #define GITHUB_OTA_PEER_INFO_SIZE  512
+    #define GITHUB_OTA_PEER_SERVICE    "ghota"
+    #define GITHUB_OTA_PEER_PROTOCOL   "tcp"
+    #define GITHUB_OTA_PEER_NAMESPACE  "ghota_peer"
+    #define GITHUB_OTA_PEER_URL        "http://%s:%d%s"
+    #define GITHUB_OTA_PEER_INFO_PATH  "/ota/info"
+    #define GITHUB_OTA_PEER_IMAGE_PATH "/ota/firmware.bin"
+
     typedef struct {
         const char* login = NULL;
         int id;
@@ -68,6 +91,7 @@
         int download_count;
         const char* created_at = NULL;
         const char* updated_at = NULL;
+        const char* digest = NULL;
         std::vector<GithubAuthor> uploader;
     } GithubReleaseAsset;
 
@@ -92,6 +116,19 @@
         std::vector<GithubAuthor> author;
     } GithubRelease;
 
+    typedef struct {
+        char tag[GITHUB_OTA_TAG_SIZE] = "";
+        int id = 0;
+        int size = 0;
+        char sha256[GITHUB_OTA_SHA256_SIZE] = "";
+        char partition[GITHUB_OTA_PARTITION_LABEL_SIZE] = "";
+    } GithubPeerImage;
+
+    typedef struct {
+        String host;
+        uint16_t port;
+    } GithubPeer;
+
     class GithubReleaseOTA {
         private:
             char* releaseUrl = NULL;
@@ -99,6 +136,11 @@
             char* ca =  NULL;
             void (*progressCallback)(int) = nullptr;
 
+            WebServer* peerServer = NULL;
+            uint16_t peerPort = 0;
+            GithubPeerImage peerImage;
+            std::vector<GithubPeer> peers;
+
         public:
             GithubReleaseOTA(const char* owner, const char* repo, const char* token = (const char*)NULL);
             ~GithubReleaseOTA();
@@ -130,9 +172,35 @@
 
             void setProgressCallback(void (*callback)(int)) { this->progressCallback = callback; }
 
+            bool beginPeerServer(uint16_t port = GITHUB_OTA_PEER_PORT, bool allowPrivate = false);
+            void handlePeerServer();
+
+            void addPeer(const char* host, uint16_t port = GITHUB_OTA_PEER_PORT);
+            int discoverPeers();
+            void clearPeers();
+
+            GithubPeerImage getPeerImage() { return this->peerImage; }
+
         private:
             String connectGithub(const char* url, int *code);
             GithubRelease makeRelease(String payload);
+
+            const char* getAssetSha256(GithubReleaseAsset asset);
+            int flashAsset(GithubReleaseAsset asset, int flashType, const char* tag);
+            int flashFromGithub(int assetId, int flashType, const char* sha256, const char* tag);
+            int flashFromPeers(GithubReleaseAsset asset, const char* sha256, const char* tag);
+            int writeStream(HTTPClient& client, int flashType, const char* sha256, char* digest, uint32_t timeout);
+
+            void freePeer();
+            bool peerHasImage(GithubPeer peer, GithubReleaseAsset asset, const char* sha256);
+            const esp_partition_t* getPeerPartition();
+            void loadPeerImage();
+            void savePeerImage(const char* tag, int id, int size, const char* sha256);
+            void clearPeerImage();
+            void invalidatePeerImage();
+            bool hashPartition(const esp_partition_t* partition, size_t size, char* digest);
+            void handlePeerInfo();
+            void handlePeerImage();
     };
 
 #endif // __GITHUB_RELEASE_OTA_H__